@@ -10,6 +10,34 @@
 #include <stdexcept>         // For standard exception classes
 #include <limits>            // For numeric limits (e.g., max() for input validation)
 #include <cctype>            // For character handling (e.g., isalpha, isspace)
+#include <memory>            // For unique_ptr and shared_ptr
+#include <thread>            // For the server worker pool
+#include <mutex>             // For locking the shared cache and job queues
+#include <condition_variable> // For waking up idle worker threads
+#include <deque>             // For the job and result queues
+#include <unordered_map>     // For looking up connected clients
+#include <cstdint>           // For fixed-width integer types
+#include <functional>        // For passing cache updates as callbacks
+#include <string_view>       // For comparing names inside the fuzzy search buffer
+#include <map>               // For reordering encoded export chunks
+#include <chrono>            // For measuring export throughput
+#include <cstdio>            // For buffered file writes (fopen, fwrite, setvbuf)
+#include <charconv>          // For fast number formatting in exports
+#include <cstring>           // For strlen and strerror
+#include <cerrno>            // For errno after failed file and socket calls
+
+#ifdef __linux__
+// POSIX headers used by the server/client mode (Unix-domain socket + epoll) and for export files
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/signalfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <csignal>
+#endif
 
 // MySQL Connector/C++ 9.x JDBC headers
 // These headers are required for connecting and interacting with MySQL database
@@ -79,7 +107,7 @@ string tolowercase(const string& str) {
 bool isValidName(const string& name) {
     if (name.empty()) return false;
     for (char c : name) {
-        if (!isalpha(static_cast<unsigned char>(c)) && (!isspace(static_cast<unsigned char>(c)))) {
+        if (!isalpha(static_cast<unsigned char>(c)) && c != ' ') {
             return false;
         }
     }
@@ -143,6 +171,9 @@ struct DatabaseConfig {
 sql::mysql::MySQL_Driver* driver = nullptr;
 unique_ptr<sql::Connection> con;
 
+// The config that connectDB() found working, reused when opening extra connections
+DatabaseConfig activeConfig;
+
 // Tries to connect to a MySQL server using the given config; returns true if successful
 bool testConnection(const DatabaseConfig& config) {
     try {
@@ -200,6 +231,7 @@ static void connectDB() {
         driver = sql::mysql::get_mysql_driver_instance();
         con.reset(driver->connect(connectionString, workingConfig.user, workingConfig.password));
         con->setSchema(workingConfig.database);
+        activeConfig = workingConfig;
 
         // Create table if it doesn't exist (with average column)
         unique_ptr<sql::Statement> stmt(con->createStatement());
@@ -240,6 +272,393 @@ void disconnectDB() {
     }
 }
 
+// Opens an additional connection using the config that connectDB() found working
+sql::Connection* openConnection() {
+    string connectionString = "tcp://" + activeConfig.host + ":" + to_string(activeConfig.port);
+    sql::Connection* extra = driver->connect(connectionString, activeConfig.user, activeConfig.password);
+    extra->setSchema(activeConfig.database);
+    return extra;
+}
+
+// Copies the current row of a "SELECT * FROM students" result into a Student
+Student readStudentRow(sql::ResultSet& res) {
+    Student s;
+    s.id = res.getInt("id");
+    s.name = res.isNull("name") ? "" : string(res.getString("name"));
+    s.section = res.isNull("section") ? "" : string(res.getString("section"));
+    s.math = res.getDouble("math");
+    s.science = res.getDouble("science");
+    s.english = res.getDouble("english");
+    s.average = res.getDouble("average");
+    s.remarks = res.isNull("remarks") ? "" : string(res.getString("remarks"));
+    s.created_at = res.isNull("created_at") ? "" : string(res.getString("created_at"));
+    s.updated_at = res.isNull("updated_at") ? "" : string(res.getString("updated_at"));
+    return s;
+}
+
+// Loads every student from the database, ordered by id
+vector<Student> loadStudents(sql::Connection& db) {
+    unique_ptr<sql::Statement> stmt(db.createStatement());
+    unique_ptr<sql::ResultSet> res(stmt->executeQuery("SELECT * FROM students ORDER BY id"));
+    vector<Student> rows;
+    while (res->next()) {
+        rows.push_back(readStudentRow(*res));
+    }
+    return rows;
+}
+
+// Shows missing (NULL or empty) text columns as [NULL] in student tables
+string displayText(const string& value) {
+    return value.empty() ? "[NULL]" : value;
+}
+
+// Prints students as the standard 132-column student table, or emptyMessage if there are none
+void printStudentTable(ostream& out, const vector<const Student*>& rows, const string& emptyMessage) {
+    out << string(132, '-') << endl;
+    out << left << setw(5) << "ID"
+        << setw(20) << "Name"
+        << setw(15) << "Section"
+        << setw(8) << "Math"
+        << setw(10) << "Science"
+        << setw(10) << "English"
+        << setw(12) << "Average"
+        << setw(20) << "Remarks"
+        << setw(20) << "Created At" << endl;
+    out << string(132, '-') << endl;
+
+    for (const Student* s : rows) {
+        out << left << setw(5) << s->id
+            << setw(20) << displayText(s->name)
+            << setw(15) << displayText(s->section)
+            << setw(8) << fixed << setprecision(1) << s->math
+            << setw(10) << s->science
+            << setw(10) << s->english
+            << setw(12) << s->average
+            << setw(20) << displayText(s->remarks)
+            << setw(20) << displayText(s->created_at) << endl;
+    }
+
+    if (rows.empty()) {
+        out << emptyMessage << endl;
+    }
+    out << string(132, '-') << endl;
+}
+
+// ==================== FUZZY NAME SEARCH ====================
+// Typo-tolerant name matching uses Myers' bit-parallel edit distance algorithm, in Hyyro's
+// formulation with his extension for transpositions: one column of the edit distance table for
+// a query of up to 64 characters is packed into 64-bit words, so each name character costs only
+// a few bit operations. A swap of two neighbouring letters ("jhon") counts as one typo.
+
+int fuzzyMaxErrors = 2;         // Most typos a fuzzy name match may contain (--max-typos N)
+bool fuzzyMaxErrorsSet = false; // --max-typos was given (the client then sends it with each lookup)
+const size_t MAX_SUGGESTIONS = 5;
+
+// Lowercased names stored back to back so a search scans one contiguous buffer
+struct NameColumn {
+    string chars;
+    vector<size_t> offsets = { 0 };     // Name i is chars[offsets[i], offsets[i + 1])
+};
+
+// Builds the name column for a list of students (same order as the list)
+NameColumn buildNameColumn(const vector<Student>& rows) {
+    NameColumn names;
+    for (const Student& s : rows) {
+        names.chars += tolowercase(s.name);
+        names.offsets.push_back(names.chars.size());
+    }
+    return names;
+}
+
+// Lowercased query plus its match masks: peq[c] has bit i set when query[i] == c
+struct FuzzyPattern {
+    string text;
+    uint64_t peq[256] = {};
+};
+
+FuzzyPattern makeFuzzyPattern(const string& query) {
+    FuzzyPattern pattern;
+    pattern.text = tolowercase(query);
+    for (size_t i = 0; i < pattern.text.size() && i < 64; i++) {
+        pattern.peq[static_cast<unsigned char>(pattern.text[i])] |= uint64_t(1) << i;
+    }
+    return pattern;
+}
+
+// Plain dynamic-programming edit distance (adjacent swaps count as one edit), used when the
+// query is longer than 64 characters
+int slowFuzzyDistance(const string& pattern, const char* text, size_t length, bool prefix) {
+    size_t m = pattern.size();
+    vector<int> before(m + 1), previous(m + 1), column(m + 1);
+    for (size_t i = 0; i <= m; i++) previous[i] = static_cast<int>(i);
+    int best = previous[m];
+    for (size_t j = 0; j < length; j++) {
+        column[0] = static_cast<int>(j + 1);
+        for (size_t i = 1; i <= m; i++) {
+            int cost = pattern[i - 1] == text[j] ? 0 : 1;
+            column[i] = min({ previous[i] + 1, column[i - 1] + 1, previous[i - 1] + cost });
+            if (i > 1 && j > 0 && pattern[i - 1] == text[j - 1] && pattern[i - 2] == text[j]) {
+                column[i] = min(column[i], before[i - 2] + 1);
+            }
+        }
+        best = min(best, column[m]);
+        before.swap(previous);
+        previous.swap(column);
+    }
+    return prefix ? best : previous[m];
+}
+
+// Edit distance between the query and a lowercased name.
+// With prefix=true the query only has to match the start of the name ("jo" matches "john").
+int fuzzyDistance(const FuzzyPattern& pattern, const char* text, size_t length, bool prefix) {
+    size_t m = pattern.text.size();
+    if (m == 0) return prefix ? 0 : static_cast<int>(length);
+    if (m > 64) return slowFuzzyDistance(pattern.text, text, length, prefix);
+
+    uint64_t vp = m == 64 ? ~uint64_t(0) : (uint64_t(1) << m) - 1;   // Vertical +1 deltas
+    uint64_t vn = 0;                                                   // Vertical -1 deltas
+    uint64_t d0 = 0;                                                   // Diagonal zero deltas
+    uint64_t previousEq = 0;
+    uint64_t last = uint64_t(1) << (m - 1);
+    int score = static_cast<int>(m);
+    int best = score;
+
+    for (size_t j = 0; j < length; j++) {
+        uint64_t eq = pattern.peq[static_cast<unsigned char>(text[j])];
+        // Query letters i-1, i equal name letters j, j-1 (a swap) where there was no match already
+        uint64_t swapped = ((~d0 & eq) << 1) & previousEq;
+        d0 = (((eq & vp) + vp) ^ vp) | eq | vn | swapped;
+        uint64_t hp = vn | ~(d0 | vp);
+        uint64_t hn = vp & d0;
+        if (hp & last) score++;
+        else if (hn & last) score--;
+
+        // The match starts at the first name character, so skipping one costs an edit (top row 0, 1, 2, ...)
+        hp = (hp << 1) | 1;
+        hn <<= 1;
+        vp = hn | ~(d0 | hp);
+        vn = hp & d0;
+        previousEq = eq;
+        if (score < best) best = score;
+    }
+    return prefix ? best : score;
+}
+
+// Fewest typos between the query and a lowercased name. With wordPrefix=true the query is
+// matched against the start of every word, so "cruz" finds "juan dela cruz" and "jo" finds "john".
+int fuzzyNameDistance(const FuzzyPattern& pattern, const char* name, size_t length, bool wordPrefix) {
+    if (!wordPrefix) return fuzzyDistance(pattern, name, length, false);
+    int best = fuzzyDistance(pattern, name, length, true);
+    for (size_t start = 1; start < length && best > 0; start++) {
+        if (name[start - 1] == ' ' && name[start] != ' ') {
+            best = min(best, fuzzyDistance(pattern, name + start, length - start, true));
+        }
+    }
+    return best;
+}
+
+// Most typos allowed for a query: at most half its letters, so short queries do not match
+// unrelated names, and never more than the --max-typos limit
+int allowedTypos(const string& query, int maxErrors) {
+    return min(maxErrors, static_cast<int>(query.size() / 2));
+}
+
+// One fuzzy match: position in the name column and number of typos
+struct FuzzyMatch {
+    size_t index = 0;
+    int distance = 0;
+};
+
+// Finds names within the allowed number of typos of the query, closest first (ties by name).
+// Searches (wordPrefix=true) match the start of any word; lookups compare the whole name.
+vector<FuzzyMatch> fuzzySearchNames(const NameColumn& names, const string& query, int maxErrors, bool wordPrefix) {
+    FuzzyPattern pattern = makeFuzzyPattern(query);
+    int allowed = allowedTypos(pattern.text, maxErrors);
+
+    vector<FuzzyMatch> matches;
+    size_t count = names.offsets.size() - 1;
+    for (size_t i = 0; i < count; i++) {
+        size_t length = names.offsets[i + 1] - names.offsets[i];
+        // A whole-name match cannot need fewer edits than the difference in length
+        if (!wordPrefix && (length > pattern.text.size() + allowed || length + allowed < pattern.text.size())) continue;
+        int distance = fuzzyNameDistance(pattern, names.chars.data() + names.offsets[i], length, wordPrefix);
+        if (distance <= allowed) matches.push_back({ i, distance });
+    }
+
+    stable_sort(matches.begin(), matches.end(), [&names](const FuzzyMatch& a, const FuzzyMatch& b) {
+        if (a.distance != b.distance) return a.distance < b.distance;
+        const char* base = names.chars.data();
+        string_view nameA(base + names.offsets[a.index], names.offsets[a.index + 1] - names.offsets[a.index]);
+        string_view nameB(base + names.offsets[b.index], names.offsets[b.index + 1] - names.offsets[b.index]);
+        return nameA < nameB;
+    });
+    return matches;
+}
+
+// Checks the fuzzy search against known names; run with --self-test (no database needed).
+// Returns the number of failed checks.
+int runFuzzySelfTest() {
+    vector<Student> roster(5);
+    const char* sampleNames[] = { "Ronald Tan", "John Cruz", "Simon Reyes", "Maria Santos", "Juan Dela Cruz" };
+    for (size_t i = 0; i < roster.size(); i++) roster[i].name = sampleNames[i];
+    NameColumn names = buildNameColumn(roster);
+
+    struct Check {
+        const char* query;
+        bool wordPrefix;
+        vector<string> expected;    // Matching names, closest first
+    };
+    const Check checks[] = {
+        { "cruz", true, { "John Cruz", "Juan Dela Cruz" } },
+        { "crux", true, { "John Cruz", "Juan Dela Cruz" } },
+        { "dela", true, { "Juan Dela Cruz" } },
+        { "sim", true, { "Simon Reyes" } },
+        { "jhon", true, { "John Cruz", "Juan Dela Cruz", "Ronald Tan" } },   // Swapped letters count as one typo
+        { "mraia", true, { "Maria Santos" } },
+        { "ronlad", true, { "Ronald Tan" } },
+        { "smion", true, { "Simon Reyes" } },
+        { "maria santso", true, { "Maria Santos" } },
+        { "Jon Cruz", false, { "John Cruz" } },
+        { "Jhon Cruz", false, { "John Cruz" } },
+        { "Simon Reyes", false, { "Simon Reyes" } },
+    };
+
+    int failures = 0;
+    for (const Check& check : checks) {
+        vector<string> actual;
+        for (const FuzzyMatch& match : fuzzySearchNames(names, check.query, 2, check.wordPrefix)) {
+            actual.push_back(roster[match.index].name);
+        }
+        bool ok = actual == check.expected;
+        if (!ok) failures++;
+        cout << (ok ? "PASS " : "FAIL ") << (check.wordPrefix ? "search" : "lookup")
+            << " \"" << check.query << "\" -> " << actual.size() << " match(es)" << endl;
+    }
+
+    // The bit-parallel distance must agree with the plain dynamic-programming version
+    const char* texts[] = { "juan dela cruz", "ronald tan", "", "a", "maria santos", "ba", "abab" };
+    const char* queries[] = { "cruz", "jaun", "x", "maria", "ronald tan jr", "a", "ab", "baba", "mraia snatos" };
+    for (const char* query : queries) {
+        FuzzyPattern pattern = makeFuzzyPattern(query);
+        for (const char* text : texts) {
+            for (bool prefix : { true, false }) {
+                size_t length = strlen(text);
+                if (fuzzyDistance(pattern, text, length, prefix) != slowFuzzyDistance(pattern.text, text, length, prefix)) {
+                    failures++;
+                    cout << "FAIL distance \"" << query << "\" vs \"" << text << "\"" << endl;
+                }
+            }
+        }
+    }
+
+    cout << (failures == 0 ? "All fuzzy search checks passed." : "Some fuzzy search checks failed.") << endl;
+    return failures;
+}
+
+// Lists close matches for a name that was not found and lets the user pick one; returns -1 to cancel
+int chooseSuggestion(const vector<const Student*>& options) {
+    cout << "\nNo exact match. Did you mean:" << endl;
+    for (size_t i = 0; i < options.size(); i++) {
+        cout << "  " << i + 1 << ". " << options[i]->name
+            << " (Section: " << options[i]->section << ", ID: " << options[i]->id << ")" << endl;
+    }
+    int choice = ValidInput("Choose a student (0 to cancel): ");
+    if (choice < 1 || choice > static_cast<int>(options.size())) return -1;
+    return choice - 1;
+}
+
+// Name index for the standalone dashboard: only ids and names, read again for every search
+// because other copies of the dashboard (or MySQL Workbench) may have changed the table
+struct NameIndex {
+    vector<int> ids;            // ids[i] belongs to name i of the column
+    NameColumn names;
+};
+
+// Loads "id, name" for every student
+NameIndex loadNameIndex() {
+    NameIndex index;
+    unique_ptr<sql::Statement> stmt(con->createStatement());
+    unique_ptr<sql::ResultSet> res(stmt->executeQuery("SELECT id, name FROM students ORDER BY id"));
+    while (res->next()) {
+        index.ids.push_back(res->getInt("id"));
+        index.names.chars += tolowercase(res->isNull("name") ? "" : string(res->getString("name")));
+        index.names.offsets.push_back(index.names.chars.size());
+    }
+    return index;
+}
+
+// Loads the full rows for the given ids, in the same order as the ids (missing ids are skipped)
+vector<Student> loadStudentsById(const vector<int>& ids) {
+    const size_t BATCH = 1000;
+    unordered_map<int, Student> byId;
+    for (size_t start = 0; start < ids.size(); start += BATCH) {
+        string query = "SELECT * FROM students WHERE id IN (";
+        for (size_t i = start; i < ids.size() && i < start + BATCH; i++) {
+            if (i > start) query += ",";
+            query += to_string(ids[i]);
+        }
+        query += ")";
+        unique_ptr<sql::Statement> stmt(con->createStatement());
+        unique_ptr<sql::ResultSet> res(stmt->executeQuery(query));
+        while (res->next()) {
+            Student s = readStudentRow(*res);
+            byId[s.id] = s;
+        }
+    }
+
+    vector<Student> rows;
+    for (int id : ids) {
+        auto it = byId.find(id);
+        if (it != byId.end()) rows.push_back(it->second);
+    }
+    return rows;
+}
+
+// Returns the students whose names fuzzily match, closest first (at most limit of them).
+// A student renamed between reading the index and fetching the rows is left out if its
+// new name no longer matches.
+vector<Student> fuzzySearchStudents(const string& name, bool wordPrefix, size_t limit) {
+    NameIndex index = loadNameIndex();
+    vector<int> ids;
+    for (const FuzzyMatch& match : fuzzySearchNames(index.names, name, fuzzyMaxErrors, wordPrefix)) {
+        if (ids.size() == limit) break;
+        ids.push_back(index.ids[match.index]);
+    }
+
+    vector<Student> rows = loadStudentsById(ids);
+    FuzzyPattern pattern = makeFuzzyPattern(name);
+    int allowed = allowedTypos(pattern.text, fuzzyMaxErrors);
+    rows.erase(remove_if(rows.begin(), rows.end(), [&](const Student& s) {
+        string current = tolowercase(s.name);
+        return fuzzyNameDistance(pattern, current.data(), current.size(), wordPrefix) > allowed;
+    }), rows.end());
+    return rows;
+}
+
+// Looks up a student by exact name, offering the closest fuzzy matches when there is none.
+// Returns false if nothing matched or the user cancelled.
+bool findStudentByName(const string& name, Student& found) {
+    unique_ptr<sql::PreparedStatement> pstmt(con->prepareStatement(
+        "SELECT * FROM students WHERE LOWER(name) = ?"
+    ));
+    pstmt->setString(1, tolowercase(name));
+    unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
+    if (res->next()) {
+        found = readStudentRow(*res);
+        return true;
+    }
+
+    vector<Student> candidates = fuzzySearchStudents(name, false, MAX_SUGGESTIONS);
+    if (candidates.empty()) return false;
+
+    vector<const Student*> options;
+    for (const Student& s : candidates) options.push_back(&s);
+    int choice = chooseSuggestion(options);
+    if (choice < 0) return false;
+    found = *options[choice];
+    return true;
+}
+
 // CRUD Functions
 // Prompts for student info and adds a new student record to the database
 void addStudent() {
@@ -289,40 +708,12 @@ void addStudent() {
 // Displays all students in the database with their details
 void viewStudents() {
     try {
-        unique_ptr<sql::Statement> stmt(con->createStatement());
-        unique_ptr<sql::ResultSet> res(stmt->executeQuery("SELECT * FROM students ORDER BY id"));
+        vector<Student> rows = loadStudents(*con);
+        vector<const Student*> all;
+        for (const Student& s : rows) all.push_back(&s);
 
         cout << "\n=== STUDENT RECORDS ===" << endl;
-        cout << string(132, '-') << endl;
-        cout << left << setw(5) << "ID"
-            << setw(20) << "Name"
-            << setw(15) << "Section"
-            << setw(8) << "Math"
-            << setw(10) << "Science"
-            << setw(10) << "English"
-            << setw(12) << "Average"
-            << setw(20) << "Remarks"
-            << setw(20) << "Created At" << endl;
-        cout << string(132, '-') << endl;
-
-        bool hasRecords = false;
-        while (res->next()) {
-            hasRecords = true;
-            cout << left << setw(5) << res->getInt("id")
-                << setw(20) << (res->isNull("name") ? "[NULL]" : res->getString("name"))
-                << setw(15) << (res->isNull("section") ? "[NULL]" : res->getString("section"))
-                << setw(8) << fixed << setprecision(1) << res->getDouble("math")
-                << setw(10) << res->getDouble("science")
-                << setw(10) << res->getDouble("english")
-                << setw(12) << res->getDouble("average")
-                << setw(20) << (res->isNull("remarks") ? "[NULL]" : res->getString("remarks"))
-                << setw(20) << (res->isNull("created_at") ? "[NULL]" : res->getString("created_at")) << endl;
-        }
-
-        if (!hasRecords) {
-            cout << "No student records found." << endl;
-        }
-        cout << string(132, '-') << endl;
+        printStudentTable(cout, all, "No student records found.");
     }
     catch (sql::SQLException& e) {
         cerr << "MySQL error: " << e.what() << endl;
@@ -342,44 +733,14 @@ void searchStudent() {
     }
 
     try {
-        unique_ptr<sql::PreparedStatement> pstmt(con->prepareStatement(
-            "SELECT * FROM students WHERE LOWER(name) LIKE ? ORDER BY name"
-        ));
-        string pattern = "%" + tolowercase(searchName) + "%";
-        pstmt->setString(1, pattern);
-        unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
+        // Names with a word starting with the query come first (0 typos), then names within
+        // the allowed typos. Only the matching rows are fetched; the names are scanned in memory.
+        vector<Student> rows = fuzzySearchStudents(searchName, true, SIZE_MAX);
+        vector<const Student*> found;
+        for (const Student& s : rows) found.push_back(&s);
 
         cout << "\n--- Search Results for \"" << searchName << "\" ---" << endl;
-        cout << string(132, '-') << endl;
-        cout << left << setw(5) << "ID"
-            << setw(20) << "Name"
-            << setw(15) << "Section"
-            << setw(8) << "Math"
-            << setw(10) << "Science"
-            << setw(10) << "English"
-            << setw(12) << "Average"
-            << setw(20) << "Remarks"
-            << setw(20) << "Created At" << endl;
-        cout << string(132, '-') << endl;
-
-        bool found = false;
-        while (res->next()) {
-            found = true;
-            cout << left << setw(5) << res->getInt("id")
-                << setw(20) << res->getString("name")
-                << setw(15) << res->getString("section")
-                << setw(8) << fixed << setprecision(1) << res->getDouble("math")
-                << setw(10) << res->getDouble("science")
-                << setw(10) << res->getDouble("english")
-                << setw(12) << res->getDouble("average")
-                << setw(20) << res->getString("remarks")
-                << setw(20) << res->getString("created_at") << endl;
-        }
-
-        if (!found) {
-            cout << "No students found with the name containing \"" << searchName << "\"." << endl;
-        }
-        cout << string(132, '-') << endl;
+        printStudentTable(cout, found, "No students found with a name close to \"" + searchName + "\".");
     }
     catch (sql::SQLException& e) {
         cerr << "MySQL error: " << e.what() << endl;
@@ -400,37 +761,15 @@ void searchSection() {
         pstmt->setString(1, tolowercase(searchSection));
         unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
 
-        cout << "\n--- Students in Section \"" << searchSection << "\" ---" << endl;
-        cout << string(132, '-') << endl;
-        cout << left << setw(5) << "ID"
-            << setw(20) << "Name"
-            << setw(15) << "Section"
-            << setw(8) << "Math"
-            << setw(10) << "Science"
-            << setw(10) << "English"
-            << setw(12) << "Average"
-            << setw(20) << "Remarks"
-            << setw(20) << "Created At" << endl;
-        cout << string(132, '-') << endl;
-
-        bool found = false;
+        vector<Student> rows;
         while (res->next()) {
-            found = true;
-            cout << left << setw(5) << res->getInt("id")
-                << setw(20) << res->getString("name")
-                << setw(15) << res->getString("section")
-                << setw(8) << fixed << setprecision(1) << res->getDouble("math")
-                << setw(10) << res->getDouble("science")
-                << setw(10) << res->getDouble("english")
-                << setw(12) << res->getDouble("average")
-                << setw(20) << res->getString("remarks")
-                << setw(20) << res->getString("created_at") << endl;
+            rows.push_back(readStudentRow(*res));
         }
+        vector<const Student*> found;
+        for (const Student& s : rows) found.push_back(&s);
 
-        if (!found) {
-            cout << "No students found in section \"" << searchSection << "\"." << endl;
-        }
-        cout << string(132, '-') << endl;
+        cout << "\n--- Students in Section \"" << searchSection << "\" ---" << endl;
+        printStudentTable(cout, found, "No students found in section \"" + searchSection + "\".");
     }
     catch (sql::SQLException& e) {
         cerr << "MySQL error: " << e.what() << endl;
@@ -450,33 +789,28 @@ void updateStudent() {
     }
 
     try {
-        unique_ptr<sql::PreparedStatement> pstmt(con->prepareStatement(
-            "SELECT * FROM students WHERE LOWER(name) = ?"
-        ));
-        pstmt->setString(1, tolowercase(name));
-        unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
-
-        if (res->next()) {
-            int id = res->getInt("id");
+        Student current;
+        if (findStudentByName(name, current)) {
+            int id = current.id;
             cout << "\n--- Current Record ---" << endl;
             cout << "ID: " << id << endl;
-            cout << "Name: " << res->getString("name") << endl;
-            cout << "Section: " << res->getString("section") << endl;
-            cout << "Math: " << res->getDouble("math") << endl;
-            cout << "Science: " << res->getDouble("science") << endl;
-            cout << "English: " << res->getDouble("english") << endl;
-            cout << "Average: " << res->getDouble("average") << endl;
-            cout << "Remarks: " << res->getString("remarks") << endl;
+            cout << "Name: " << current.name << endl;
+            cout << "Section: " << current.section << endl;
+            cout << "Math: " << current.math << endl;
+            cout << "Science: " << current.science << endl;
+            cout << "English: " << current.english << endl;
+            cout << "Average: " << current.average << endl;
+            cout << "Remarks: " << current.remarks << endl;
 
             string newName, newSection;
             cout << "\n--- Enter New Information ---" << endl;
             cout << "Enter new name (or press Enter to keep current): ";
             getline(cin, newName);
-            if (newName.empty()) newName = res->getString("name");
+            if (newName.empty()) newName = current.name;
 
             cout << "Enter new section (or press Enter to keep current): ";
             getline(cin, newSection);
-            if (newSection.empty()) newSection = res->getString("section");
+            if (newSection.empty()) newSection = current.section;
 
             cout << "Current grades will be updated. Enter new grades:" << endl;
             double newMath = ValidGrade("Math");
@@ -520,20 +854,15 @@ void deleteStudent() {
 
     try {
         // First show the student to be deleted
-        unique_ptr<sql::PreparedStatement> selectStmt(con->prepareStatement(
-            "SELECT * FROM students WHERE LOWER(name) = ?"
-        ));
-        selectStmt->setString(1, tolowercase(name));
-        unique_ptr<sql::ResultSet> res(selectStmt->executeQuery());
-
-        if (res->next()) {
+        Student target;
+        if (findStudentByName(name, target)) {
             cout << "\n--- Student to be deleted ---" << endl;
-            cout << "Name: " << res->getString("name") << endl;
-            cout << "Section: " << res->getString("section") << endl;
-            cout << "Math: " << res->getDouble("math") << endl;
-            cout << "Science: " << res->getDouble("science") << endl;
-            cout << "English: " << res->getDouble("english") << endl;
-            cout << "Average: " << res->getDouble("average") << endl;
+            cout << "Name: " << target.name << endl;
+            cout << "Section: " << target.section << endl;
+            cout << "Math: " << target.math << endl;
+            cout << "Science: " << target.science << endl;
+            cout << "English: " << target.english << endl;
+            cout << "Average: " << target.average << endl;
 
             char confirm;
             cout << "\nAre you sure you want to delete this student? (Y/N): ";
@@ -542,9 +871,9 @@ void deleteStudent() {
 
             if (toupper(confirm) == 'Y') {
                 unique_ptr<sql::PreparedStatement> deleteStmt(con->prepareStatement(
-                    "DELETE FROM students WHERE LOWER(name) = ?"
+                    "DELETE FROM students WHERE id = ?"
                 ));
-                deleteStmt->setString(1, tolowercase(name));
+                deleteStmt->setInt(1, target.id);
                 int affected = deleteStmt->executeUpdate();
 
                 if (affected > 0) {
@@ -587,6 +916,63 @@ double findMin(const vector<double>& grades) {
     return *min_element(grades.begin(), grades.end());
 }
 
+// Prints the analytics dashboard (per-subject highest/lowest/average and performance distribution)
+void printAnalytics(ostream& out, const vector<double>& math, const vector<double>& science,
+    const vector<double>& english, const vector<double>& averages) {
+    out << "\n=== GRADE ANALYTICS DASHBOARD ===" << endl;
+    if (!math.empty()) {
+        out << string(80, '=') << endl;
+        out << left << setw(12) << "Subject"
+            << setw(12) << "Highest"
+            << setw(12) << "Lowest"
+            << setw(12) << "Average"
+            << setw(12) << "Students" << endl;
+        out << string(80, '-') << endl;
+
+        out << left << setw(12) << "Math"
+            << setw(12) << fixed << setprecision(1) << findMax(math)
+            << setw(12) << findMin(math)
+            << setw(12) << calculateMean(math)
+            << setw(12) << math.size() << endl;
+
+        out << left << setw(12) << "Science"
+            << setw(12) << findMax(science)
+            << setw(12) << findMin(science)
+            << setw(12) << calculateMean(science)
+            << setw(12) << science.size() << endl;
+
+        out << left << setw(12) << "English"
+            << setw(12) << findMax(english)
+            << setw(12) << findMin(english)
+            << setw(12) << calculateMean(english)
+            << setw(12) << english.size() << endl;
+
+        out << string(80, '-') << endl;
+        out << left << setw(12) << "Overall"
+            << setw(12) << findMax(averages)
+            << setw(12) << findMin(averages)
+            << setw(12) << calculateMean(averages)
+            << setw(12) << averages.size() << endl;
+        out << string(80, '=') << endl;
+
+        // Performance distribution
+        int excellent = 0, good = 0, needsImprovement = 0;
+        for (double avg : averages) {
+            if (avg >= 90) excellent++;
+            else if (avg >= 75) good++;
+            else needsImprovement++;
+        }
+
+        out << "\n--- Performance Distribution ---" << endl;
+        out << "Excellent (90+): " << excellent << " students" << endl;
+        out << "Good (75-89): " << good << " students" << endl;
+        out << "Needs Improvement (<75): " << needsImprovement << " students" << endl;
+    }
+    else {
+        out << "No student data available for analytics." << endl;
+    }
+}
+
 // Displays analytics for all students: highest, lowest, average per subject, and performance distribution
 void displayAnalytics() {
     try {
@@ -605,88 +991,1566 @@ void displayAnalytics() {
             averages.push_back(a);
         }
 
-        cout << "\n=== GRADE ANALYTICS DASHBOARD ===" << endl;
-        if (!math.empty()) {
-            cout << string(80, '=') << endl;
-            cout << left << setw(12) << "Subject"
-                << setw(12) << "Highest"
-                << setw(12) << "Lowest"
-                << setw(12) << "Average"
-                << setw(12) << "Students" << endl;
-            cout << string(80, '-') << endl;
-
-            cout << left << setw(12) << "Math"
-                << setw(12) << fixed << setprecision(1) << findMax(math)
-                << setw(12) << findMin(math)
-                << setw(12) << calculateMean(math)
-                << setw(12) << math.size() << endl;
-
-            cout << left << setw(12) << "Science"
-                << setw(12) << findMax(science)
-                << setw(12) << findMin(science)
-                << setw(12) << calculateMean(science)
-                << setw(12) << science.size() << endl;
-
-            cout << left << setw(12) << "English"
-                << setw(12) << findMax(english)
-                << setw(12) << findMin(english)
-                << setw(12) << calculateMean(english)
-                << setw(12) << english.size() << endl;
-
-            cout << string(80, '-') << endl;
-            cout << left << setw(12) << "Overall"
-                << setw(12) << findMax(averages)
-                << setw(12) << findMin(averages)
-                << setw(12) << calculateMean(averages)
-                << setw(12) << averages.size() << endl;
-            cout << string(80, '=') << endl;
-
-            // Performance distribution
-            int excellent = 0, good = 0, needsImprovement = 0;
-            for (double avg : averages) {
-                if (avg >= 90) excellent++;
-                else if (avg >= 75) good++;
-                else needsImprovement++;
+        printAnalytics(cout, math, science, english, averages);
+    }
+    catch (sql::SQLException& e) {
+        cerr << "MySQL error: " << e.what() << endl;
+    }
+}
+
+// ==================== EXPORT ====================
+// Streams the students table and the analytics summary to CSV or JSON files.
+// Rows are read in batches of EXPORT_FETCH_SIZE (keyset pagination on id) so memory stays
+// flat, batches are encoded by a few worker threads in parallel, and a writer thread appends
+// the encoded chunks to the file in their original order through a large stdio buffer.
+
+const int EXPORT_FETCH_SIZE = 10000;            // Rows per database round trip (and per encoded chunk)
+const size_t EXPORT_WRITE_BUFFER = 1 << 20;     // stdio buffer size for export files
+
+string serverExportDir = "exports";             // Only folder the server writes client exports to (--export-dir DIR)
+
+// Running highest/lowest/total of one grade column, so analytics can be built while streaming
+struct GradeSummary {
+    double highest = 0;
+    double lowest = 0;
+    double total = 0;
+    size_t count = 0;
+};
+
+// Same numbers displayAnalytics() shows, accumulated one student at a time
+struct ExportSummary {
+    GradeSummary math, science, english, overall;
+    int excellent = 0, good = 0, needsImprovement = 0;
+};
+
+// Adds one grade to a running summary
+void addGrade(GradeSummary& summary, double grade) {
+    if (summary.count == 0 || grade > summary.highest) summary.highest = grade;
+    if (summary.count == 0 || grade < summary.lowest) summary.lowest = grade;
+    summary.total += grade;
+    summary.count++;
+}
+
+// Adds one student's grades and remarks bucket to the export summary
+void addToSummary(ExportSummary& summary, const Student& s) {
+    addGrade(summary.math, s.math);
+    addGrade(summary.science, s.science);
+    addGrade(summary.english, s.english);
+    addGrade(summary.overall, s.average);
+    if (s.average >= 90) summary.excellent++;
+    else if (s.average >= 75) summary.good++;
+    else summary.needsImprovement++;
+}
+
+// Appends a number in its shortest exact form (e.g. 85, 92.5, 94.66666666666667)
+void appendNumber(string& out, double value) {
+    char buffer[32];
+    to_chars_result result = to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, result.ptr);
+}
+
+// Appends an integer (ids, counts) in plain digits; to_chars on a double may pick 1e+05
+void appendInteger(string& out, long long value) {
+    char buffer[24];
+    to_chars_result result = to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, result.ptr);
+}
+
+// Appends a CSV field, quoting it when it contains a comma, quote or line break
+void appendCsvField(string& out, const string& field) {
+    if (field.find_first_of(",\"\r\n") == string::npos) {
+        out += field;
+        return;
+    }
+    out += '"';
+    for (char c : field) {
+        if (c == '"') out += '"';
+        out += c;
+    }
+    out += '"';
+}
+
+// Appends a JSON string literal with the required escapes
+void appendJsonString(string& out, const string& text) {
+    out += '"';
+    for (char c : text) {
+        switch (c) {
+        case '"': out += "\\\""; break;
+        case '\\': out += "\\\\"; break;
+        case '\n': out += "\\n"; break;
+        case '\r': out += "\\r"; break;
+        case '\t': out += "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                char escaped[8];
+                snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+                out += escaped;
+            }
+            else {
+                out += c;
             }
+        }
+    }
+    out += '"';
+}
 
-            cout << "\n--- Performance Distribution ---" << endl;
-            cout << "Excellent (90+): " << excellent << " students" << endl;
-            cout << "Good (75-89): " << good << " students" << endl;
-            cout << "Needs Improvement (<75): " << needsImprovement << " students" << endl;
+// Encodes one batch of students as CSV lines or JSON array elements
+string encodeChunk(const vector<Student>& rows, bool json, bool firstChunk) {
+    string out;
+    out.reserve(rows.size() * 160);
+    for (size_t i = 0; i < rows.size(); i++) {
+        const Student& s = rows[i];
+        if (json) {
+            out += (firstChunk && i == 0) ? "\n    {\"id\":" : ",\n    {\"id\":";
+            appendInteger(out, s.id);
+            out += ",\"name\":"; appendJsonString(out, s.name);
+            out += ",\"section\":"; appendJsonString(out, s.section);
+            out += ",\"math\":"; appendNumber(out, s.math);
+            out += ",\"science\":"; appendNumber(out, s.science);
+            out += ",\"english\":"; appendNumber(out, s.english);
+            out += ",\"average\":"; appendNumber(out, s.average);
+            out += ",\"remarks\":"; appendJsonString(out, s.remarks);
+            out += ",\"created_at\":"; appendJsonString(out, s.created_at);
+            out += ",\"updated_at\":"; appendJsonString(out, s.updated_at);
+            out += '}';
         }
         else {
-            cout << "No student data available for analytics." << endl;
+            appendInteger(out, s.id); out += ',';
+            appendCsvField(out, s.name); out += ',';
+            appendCsvField(out, s.section); out += ',';
+            appendNumber(out, s.math); out += ',';
+            appendNumber(out, s.science); out += ',';
+            appendNumber(out, s.english); out += ',';
+            appendNumber(out, s.average); out += ',';
+            appendCsvField(out, s.remarks); out += ',';
+            appendCsvField(out, s.created_at); out += ',';
+            appendCsvField(out, s.updated_at); out += '\n';
+        }
+    }
+    return out;
+}
+
+// Encodes the analytics summary: a CSV file of its own, or the "analytics" member of the JSON file
+string encodeSummary(const ExportSummary& summary, bool json) {
+    const pair<const char*, const GradeSummary*> subjects[] = {
+        { "Math", &summary.math }, { "Science", &summary.science },
+        { "English", &summary.english }, { "Overall", &summary.overall },
+    };
+
+    string out;
+    if (json) {
+        out += "\"analytics\": {\n    \"subjects\": [";
+        for (size_t i = 0; i < 4; i++) {
+            const GradeSummary& g = *subjects[i].second;
+            out += i == 0 ? "\n      {\"subject\":" : ",\n      {\"subject\":";
+            appendJsonString(out, subjects[i].first);
+            out += ",\"highest\":"; appendNumber(out, g.highest);
+            out += ",\"lowest\":"; appendNumber(out, g.lowest);
+            out += ",\"average\":"; appendNumber(out, g.count ? g.total / g.count : 0);
+            out += ",\"students\":"; appendInteger(out, static_cast<long long>(g.count));
+            out += '}';
+        }
+        out += "\n    ],\n    \"distribution\": {\"excellent\":" + to_string(summary.excellent)
+            + ",\"good\":" + to_string(summary.good)
+            + ",\"needs_improvement\":" + to_string(summary.needsImprovement) + "}\n  }";
+    }
+    else {
+        out += "subject,highest,lowest,average,students\n";
+        for (const auto& subject : subjects) {
+            const GradeSummary& g = *subject.second;
+            out += subject.first; out += ',';
+            appendNumber(out, g.highest); out += ',';
+            appendNumber(out, g.lowest); out += ',';
+            appendNumber(out, g.count ? g.total / g.count : 0); out += ',';
+            out += to_string(g.count) + "\n";
+        }
+        out += "\nremarks,students\n";
+        out += "Excellent (90+)," + to_string(summary.excellent) + "\n";
+        out += "Good (75-89)," + to_string(summary.good) + "\n";
+        out += "Needs Improvement (<75)," + to_string(summary.needsImprovement) + "\n";
+    }
+    return out;
+}
+
+// Chunks moving from the reader to the encoders and on to the writer, numbered in read order
+struct ExportPipeline {
+    mutex lock;
+    condition_variable changed;             // Signalled whenever a chunk moves between stages
+    deque<pair<size_t, vector<Student>>> toEncode;
+    map<size_t, string> encoded;
+    size_t chunksRead = 0;
+    size_t inFlight = 0;                    // Chunks read but not yet written
+    bool readingDone = false;
+    bool failed = false;                    // A chunk could not be encoded or written
+};
+
+// Encoder thread body: turns batches of students into text until the reader is done
+void exportEncoder(ExportPipeline& pipeline, bool json) {
+    while (true) {
+        pair<size_t, vector<Student>> chunk;
+        {
+            unique_lock<mutex> guard(pipeline.lock);
+            pipeline.changed.wait(guard, [&pipeline] { return !pipeline.toEncode.empty() || pipeline.readingDone; });
+            if (pipeline.toEncode.empty() || pipeline.failed) return;
+            chunk = move(pipeline.toEncode.front());
+            pipeline.toEncode.pop_front();
+        }
+
+        try {
+            string text = encodeChunk(chunk.second, json, chunk.first == 0);
+            lock_guard<mutex> guard(pipeline.lock);
+            pipeline.encoded[chunk.first] = move(text);
+        }
+        catch (exception&) {
+            // Out of memory: the writer would wait for this chunk forever, so stop the export
+            lock_guard<mutex> guard(pipeline.lock);
+            pipeline.failed = true;
+        }
+        pipeline.changed.notify_all();
+    }
+}
+
+// Writer thread body: writes encoded chunks to the file strictly in read order
+void exportWriter(ExportPipeline& pipeline, FILE* file, size_t& bytesWritten) {
+    size_t next = 0;
+    while (true) {
+        string text;
+        {
+            unique_lock<mutex> guard(pipeline.lock);
+            pipeline.changed.wait(guard, [&pipeline, next] {
+                return pipeline.encoded.count(next) > 0 || pipeline.failed
+                    || (pipeline.readingDone && next == pipeline.chunksRead);
+            });
+            auto it = pipeline.encoded.find(next);
+            if (it == pipeline.encoded.end() || pipeline.failed) return;
+            text = move(it->second);
+            pipeline.encoded.erase(it);
+        }
+
+        bool ok = fwrite(text.data(), 1, text.size(), file) == text.size();
+        bytesWritten += text.size();
+
+        lock_guard<mutex> guard(pipeline.lock);
+        if (!ok) pipeline.failed = true;
+        pipeline.inFlight--;
+        next++;
+        pipeline.changed.notify_all();
+    }
+}
+
+// Opens an export file with a large write buffer; returns nullptr and reports the error on failure.
+// On Linux a symlink at the path is refused rather than followed, and new files get mode 0640.
+FILE* openExportFile(const string& path, ostream& report) {
+#ifdef __linux__
+    FILE* file = nullptr;
+    int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_NOFOLLOW | O_CLOEXEC, 0640);
+    if (fd >= 0) {
+        file = fdopen(fd, "wb");
+        if (!file) close(fd);
+    }
+#else
+    FILE* file = fopen(path.c_str(), "wb");
+#endif
+    if (!file) {
+        report << "Could not open " << path << " for writing: " << strerror(errno) << endl;
+        return nullptr;
+    }
+    setvbuf(file, nullptr, _IOFBF, EXPORT_WRITE_BUFFER);
+    return file;
+}
+
+// Exports all students plus the analytics summary.
+// CSV writes <baseName>_students.csv and <baseName>_analytics.csv; JSON writes <baseName>.json.
+// Returns false if a file could not be written; database errors are thrown to the caller.
+bool exportData(sql::Connection& db, const string& format, const string& baseName, ostream& report) {
+    bool json = format == "json";
+    string studentsPath = json ? baseName + ".json" : baseName + "_students.csv";
+    string analyticsPath = json ? studentsPath : baseName + "_analytics.csv";
+
+    FILE* file = openExportFile(studentsPath, report);
+    if (!file) return false;
+
+    auto started = chrono::steady_clock::now();
+    const char* header = json ? "{\n  \"students\": [" : "id,name,section,math,science,english,average,remarks,created_at,updated_at\n";
+    size_t bytesWritten = fwrite(header, 1, strlen(header), file);
+
+    unsigned encoderCount = max(2u, min(8u, thread::hardware_concurrency()));
+    size_t maxInFlight = encoderCount * 2 + 2;
+    ExportPipeline pipeline;
+    vector<thread> encoders;
+    encoders.reserve(encoderCount);
+    thread writer;
+
+    // Stops whichever pipeline threads were started; safe to call once reading has finished or failed
+    auto finishPipeline = [&]() {
+        {
+            lock_guard<mutex> guard(pipeline.lock);
+            pipeline.readingDone = true;
+        }
+        pipeline.changed.notify_all();
+        for (thread& encoder : encoders) encoder.join();
+        if (writer.joinable()) writer.join();
+    };
+
+    ExportSummary summary;
+    size_t rowCount = 0;
+    try {
+        // Starting a thread can throw too, so it happens inside the try that joins them
+        for (unsigned i = 0; i < encoderCount; i++) {
+            encoders.emplace_back(exportEncoder, ref(pipeline), json);
+        }
+        writer = thread(exportWriter, ref(pipeline), file, ref(bytesWritten));
+
+        unique_ptr<sql::PreparedStatement> pstmt(db.prepareStatement(
+            "SELECT * FROM students WHERE id > ? ORDER BY id LIMIT ?"
+        ));
+        int lastId = 0;
+        while (true) {
+            {
+                // Wait for the writer to catch up so only a few chunks are held in memory
+                unique_lock<mutex> guard(pipeline.lock);
+                pipeline.changed.wait(guard, [&] { return pipeline.inFlight < maxInFlight || pipeline.failed; });
+                if (pipeline.failed) break;
+            }
+
+            pstmt->setInt(1, lastId);
+            pstmt->setInt(2, EXPORT_FETCH_SIZE);
+            unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
+            vector<Student> batch;
+            batch.reserve(EXPORT_FETCH_SIZE);
+            while (res->next()) {
+                batch.push_back(readStudentRow(*res));
+                addToSummary(summary, batch.back());
+            }
+            if (batch.empty()) break;
+
+            lastId = batch.back().id;
+            rowCount += batch.size();
+            bool lastBatch = batch.size() < static_cast<size_t>(EXPORT_FETCH_SIZE);
+            {
+                lock_guard<mutex> guard(pipeline.lock);
+                pipeline.toEncode.push_back({ pipeline.chunksRead++, move(batch) });
+                pipeline.inFlight++;
+            }
+            pipeline.changed.notify_all();
+            if (lastBatch) break;
         }
     }
+    catch (...) {
+        finishPipeline();
+        fclose(file);
+        throw;
+    }
+    finishPipeline();
+
+    bool ok = !pipeline.failed;
+    if (json) {
+        string tail = "\n  ],\n  " + encodeSummary(summary, true) + "\n}\n";
+        ok = ok && fwrite(tail.data(), 1, tail.size(), file) == tail.size();
+        bytesWritten += tail.size();
+    }
+    ok = (fclose(file) == 0) && ok;
+
+    if (!json && ok) {
+        FILE* analyticsFile = openExportFile(analyticsPath, report);
+        if (!analyticsFile) return false;
+        string text = encodeSummary(summary, false);
+        ok = fwrite(text.data(), 1, text.size(), analyticsFile) == text.size();
+        ok = (fclose(analyticsFile) == 0) && ok;
+        bytesWritten += text.size();
+    }
+
+    if (!ok) {
+        report << "Failed while writing the export files." << endl;
+        return false;
+    }
+
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+    double megabytes = bytesWritten / (1024.0 * 1024.0);
+    report << "✓ Exported " << rowCount << " students to " << studentsPath << endl;
+    if (!json) report << "✓ Analytics summary written to " << analyticsPath << endl;
+    report << fixed << setprecision(2) << megabytes << " MB in " << seconds << " s ("
+        << setprecision(0) << (seconds > 0 ? rowCount / seconds : 0) << " rows/s, "
+        << setprecision(1) << (seconds > 0 ? megabytes / seconds : 0) << " MB/s, "
+        << encoderCount << " encoder threads)" << endl;
+    return true;
+}
+
+// Prompts for the export format (csv or json) and the output file name without extension
+void promptExportOptions(string& format, string& baseName) {
+    cout << "Enter format (csv/json): ";
+    getline(cin, format);
+    format = tolowercase(format);
+    while (format != "csv" && format != "json") {
+        cout << "Please enter csv or json.\n";
+        cout << "Enter format (csv/json): ";
+        getline(cin, format);
+        format = tolowercase(format);
+    }
+
+    cout << "Enter output file name without extension (or press Enter for \"grades_export\"): ";
+    getline(cin, baseName);
+    if (baseName.empty()) baseName = "grades_export";
+}
+
+// Prompts for a format and file name, then exports students and analytics
+void exportReports() {
+    string format, baseName;
+    cout << "\n=== EXPORT DATA ===" << endl;
+    promptExportOptions(format, baseName);
+
+    try {
+        exportData(*con, format, baseName, cout);
+    }
     catch (sql::SQLException& e) {
         cerr << "MySQL error: " << e.what() << endl;
     }
+    catch (exception& e) {
+        cerr << "Export failed: " << e.what() << endl;
+    }
 }
 
-// Main menu loop: connects to DB, displays menu, dispatches to functions, and closes DB on exit
-int main() {
-    cout << "=== GRADE ANALYTICS DASHBOARD ===" << endl;
-    cout << "Initializing database connection..." << endl;
+// Prints the main menu options
+void printMenu() {
+    cout << "\n" << string(50, '=') << endl;
+    cout << "         GRADE ANALYTICS DASHBOARD" << endl;
+    cout << string(50, '=') << endl;
+    cout << "1. Add Student" << endl;
+    cout << "2. View All Students" << endl;
+    cout << "3. Update Student" << endl;
+    cout << "4. Delete Student" << endl;
+    cout << "5. Search by Section" << endl;
+    cout << "6. Search Student" << endl;
+    cout << "7. View Analytics" << endl;
+    cout << "8. Export Data" << endl;
+    cout << "9. Exit" << endl;
+    cout << string(50, '=') << endl;
+}
 
-    connectDB();
+#ifdef __linux__
+// ==================== SERVER / CLIENT MODE ====================
+// Server mode hosts the dashboard operations behind a Unix-domain socket so that many
+// teachers share one set of database connections and one cached copy of the students table.
+// Protocol: each request is one line of tab-separated fields (e.g. "SEARCH\tjuan").
+// Each response is a "<STATUS> <length>" line followed by exactly <length> bytes of text.
+
+const string DEFAULT_SOCKET_PATH = "/tmp/grades_dashboard.sock";
+const int SERVER_WORKERS = 4;               // Worker threads, each with its own MySQL connection
+const size_t MAX_REQUEST_LINE = 4096;       // Longest request line accepted from a client
+const size_t MAX_PENDING_INPUT = 65536;     // Most unhandled bytes buffered for one client
+const mode_t SOCKET_PERMISSIONS = 0660;     // Owner and group may connect (teachers share the server's group)
+
+// Cached copy of the students table (ordered by id) with its name column for fuzzy search
+struct CachedRoster {
+    vector<Student> students;
+    NameColumn names;
+    chrono::steady_clock::time_point loadedAt;   // When the rows were read from the database
+};
 
-    int choice;
-    do {
-        clearScreen();
-        cout << "\n" << string(50, '=') << endl;
-        cout << "         GRADE ANALYTICS DASHBOARD" << endl;
-        cout << string(50, '=') << endl;
-        cout << "1. Add Student" << endl;
-        cout << "2. View All Students" << endl;
-        cout << "3. Update Student" << endl;
-        cout << "4. Delete Student" << endl;
-        cout << "5. Search by Section" << endl;
-        cout << "6. Search Student" << endl;
-        cout << "7. View Analytics" << endl;
-        cout << "8. Exit" << endl;
-        cout << string(50, '=') << endl;
-
-        choice = ValidInput("Enter your choice (1-8): ");
+// How long a cached roster is served before it is read again, so that changes made outside
+// the server (standalone mode, MySQL Workbench) show up without a restart
+const chrono::seconds CACHE_MAX_AGE(5);
+
+// Shared warm cache of the students table.
+// Writes are applied to a copy of the cached roster instead of dropping it, and only one
+// worker reloads a cold or expired cache while the others wait for (or keep serving) the old one.
+struct StudentCache {
+    mutex lock;
+    condition_variable loaded;                // Signalled when a reload finishes
+    shared_ptr<const CachedRoster> rows;      // nullptr while the cache is cold
+    bool loading = false;                     // A worker is reloading the cache
+    unsigned long generation = 0;             // Bumped on every write so stale reloads are discarded
+    mutex writeLock;                          // Keeps database writes and cache updates in the same order
+};
+
+StudentCache studentCache;
+
+// Returns the cached students, reloading them from the database if the cache is cold or expired
+shared_ptr<const CachedRoster> getCachedStudents(sql::Connection& db) {
+    unique_lock<mutex> guard(studentCache.lock);
+    studentCache.loaded.wait(guard, [] { return studentCache.rows || !studentCache.loading; });
+    shared_ptr<const CachedRoster> current = studentCache.rows;
+    bool expired = !current || chrono::steady_clock::now() - current->loadedAt >= CACHE_MAX_AGE;
+    // An expired roster is still served while another worker reads the new one
+    if (!expired || studentCache.loading) return current;
+
+    studentCache.loading = true;
+    unsigned long generation = studentCache.generation;
+    guard.unlock();
+
+    auto fresh = make_shared<CachedRoster>();
+    try {
+        fresh->loadedAt = chrono::steady_clock::now();
+        fresh->students = loadStudents(db);
+        fresh->names = buildNameColumn(fresh->students);
+    }
+    catch (...) {
+        guard.lock();
+        studentCache.loading = false;
+        studentCache.loaded.notify_all();
+        throw;
+    }
+
+    guard.lock();
+    studentCache.loading = false;
+    // A write during the reload may be missing from it, so keep the cached roster
+    // (which the write was applied to) and let a later reader try again
+    if (studentCache.generation == generation) {
+        studentCache.rows = fresh;
+    }
+    studentCache.loaded.notify_all();
+    return fresh;
+}
+
+// Applies a change to a copy of the cached roster after a successful database write.
+// Call with studentCache.writeLock held so the cache sees writes in database order;
+// the copy is built outside studentCache.lock so readers are not held up by it.
+void updateStudentCache(const function<void(vector<Student>&)>& change) {
+    shared_ptr<const CachedRoster> base;
+    {
+        lock_guard<mutex> guard(studentCache.lock);
+        studentCache.generation++;
+        base = studentCache.rows;
+    }
+    if (!base) return;     // Cold: the next reload reads the change
+
+    auto updated = make_shared<CachedRoster>();
+    updated->loadedAt = base->loadedAt;
+    updated->students = base->students;
+    change(updated->students);
+    updated->names = buildNameColumn(updated->students);
+
+    lock_guard<mutex> guard(studentCache.lock);
+    // Anything installed since was read from the database after the write
+    if (studentCache.rows == base) {
+        studentCache.rows = updated;
+    }
+}
+
+// Drops the cached students when a write cannot be applied to them; the next read reloads
+void dropStudentCache() {
+    lock_guard<mutex> guard(studentCache.lock);
+    studentCache.rows.reset();
+    studentCache.generation++;
+}
+
+// Finds a student by id in a roster ordered by id
+vector<Student>::iterator findById(vector<Student>& rows, int id) {
+    auto it = lower_bound(rows.begin(), rows.end(), id, [](const Student& s, int value) { return s.id < value; });
+    return (it != rows.end() && it->id == id) ? it : rows.end();
+}
+
+// Result of one server request: a status word and the text to show the user
+struct ServiceReply {
+    string status = "OK";     // OK, SUGGEST, NOTFOUND or ERR
+    string body = "";
+};
+
+// Splits a string on a single-character delimiter
+vector<string> splitFields(const string& line, char delimiter) {
+    vector<string> fields;
+    string field;
+    istringstream stream(line);
+    while (getline(stream, field, delimiter)) {
+        fields.push_back(field);
+    }
+    if (!line.empty() && line.back() == delimiter) fields.push_back("");
+    return fields;
+}
+
+// Replaces tabs and line breaks so free text (typed by a user or stored in the database)
+// cannot split a field or a line of the protocol
+string stripTabs(string text) {
+    replace_if(text.begin(), text.end(), [](char c) { return c == '\t' || c == '\n' || c == '\r'; }, ' ');
+    return text;
+}
+
+// Joins fields with tabs into one request/record line; every field goes through stripTabs()
+string joinFields(const vector<string>& fields) {
+    string line;
+    for (size_t i = 0; i < fields.size(); i++) {
+        if (i > 0) line += '\t';
+        line += stripTabs(fields[i]);
+    }
+    return line;
+}
+
+// Formats a student as one tab-separated record line: id, name, section, math, science, english, average, remarks
+string recordLine(const Student& s) {
+    return joinFields({ to_string(s.id), s.name, s.section, to_string(s.math),
+        to_string(s.science), to_string(s.english), to_string(s.average), s.remarks });
+}
+
+// Parses a record line produced by recordLine(); returns false if it is malformed
+bool parseRecordLine(const string& line, Student& s) {
+    vector<string> fields = splitFields(line, '\t');
+    if (fields.size() < 8) return false;
+    try {
+        s.id = stoi(fields[0]);
+        s.name = fields[1];
+        s.section = fields[2];
+        s.math = stod(fields[3]);
+        s.science = stod(fields[4]);
+        s.english = stod(fields[5]);
+        s.average = stod(fields[6]);
+        s.remarks = fields[7];
+    }
+    catch (const exception&) {
+        return false;
+    }
+    return true;
+}
+
+// Parses a grade sent by a client; returns false if it is not a number between 0 and 100
+bool parseGrade(const string& text, double& grade) {
+    try {
+        size_t used = 0;
+        grade = stod(text, &used);
+        return used == text.size() && grade >= 0 && grade <= 100;
+    }
+    catch (const exception&) {
+        return false;
+    }
+}
+
+// Parses the optional typo limit a client sends with SEARCH/GET; falls back to the server's setting
+int parseMaxErrors(const string& text) {
+    if (text.empty() || text.size() > 2 || !all_of(text.begin(), text.end(), ::isdigit)) return fuzzyMaxErrors;
+    return stoi(text);
+}
+
+// Checks that a client-supplied export name stays inside the server's export folder
+bool isSafeExportName(const string& name) {
+    return !name.empty() && name.find('/') == string::npos && name.find("..") == string::npos;
+}
+
+// Sorts students by name the same way "ORDER BY name" does (case-insensitive)
+void sortByName(vector<const Student*>& rows) {
+    stable_sort(rows.begin(), rows.end(), [](const Student* a, const Student* b) {
+        return tolowercase(a->name) < tolowercase(b->name);
+    });
+}
+
+// Runs one request against the cache/database and builds the reply text
+ServiceReply handleRequest(sql::Connection& db, const vector<string>& fields) {
+    ServiceReply reply;
+    ostringstream out;
+    const string command = fields.empty() ? "" : fields[0];
+
+    if (command == "VIEW" && fields.size() == 1) {
+        auto rows = getCachedStudents(db);
+        vector<const Student*> all;
+        for (const Student& s : rows->students) all.push_back(&s);
+        out << "\n=== STUDENT RECORDS ===" << endl;
+        printStudentTable(out, all, "No student records found.");
+    }
+    else if (command == "SEARCH" && (fields.size() == 2 || fields.size() == 3)) {
+        // Optional third field overrides the server's maximum number of typos
+        auto rows = getCachedStudents(db);
+        int maxErrors = fields.size() == 3 ? parseMaxErrors(fields[2]) : fuzzyMaxErrors;
+        vector<const Student*> matches;
+        for (const FuzzyMatch& match : fuzzySearchNames(rows->names, fields[1], maxErrors, true)) {
+            matches.push_back(&rows->students[match.index]);
+        }
+        out << "\n--- Search Results for \"" << fields[1] << "\" ---" << endl;
+        printStudentTable(out, matches, "No students found with a name close to \"" + fields[1] + "\".");
+    }
+    else if (command == "SECTION" && fields.size() == 2) {
+        auto rows = getCachedStudents(db);
+        string wanted = tolowercase(fields[1]);
+        vector<const Student*> matches;
+        for (const Student& s : rows->students) {
+            if (tolowercase(s.section) == wanted) matches.push_back(&s);
+        }
+        sortByName(matches);
+        out << "\n--- Students in Section \"" << fields[1] << "\" ---" << endl;
+        printStudentTable(out, matches, "No students found in section \"" + fields[1] + "\".");
+    }
+    else if (command == "ANALYTICS" && fields.size() == 1) {
+        auto rows = getCachedStudents(db);
+        vector<double> math, science, english, averages;
+        for (const Student& s : rows->students) {
+            math.push_back(s.math);
+            science.push_back(s.science);
+            english.push_back(s.english);
+            averages.push_back(s.average);
+        }
+        printAnalytics(out, math, science, english, averages);
+    }
+    else if (command == "GET" && (fields.size() == 2 || fields.size() == 3)) {
+        // Returns the first student whose name matches exactly (case-insensitive) as one record line.
+        // Without an exact match, status SUGGEST lists the closest names, one record line each
+        // (an optional third field overrides the server's maximum number of typos).
+        auto rows = getCachedStudents(db);
+        string wanted = tolowercase(fields[1]);
+        reply.status = "NOTFOUND";
+        for (const Student& s : rows->students) {
+            if (tolowercase(s.name) == wanted) {
+                out << recordLine(s) << "\n";
+                reply.status = "OK";
+                break;
+            }
+        }
+        if (reply.status == "NOTFOUND") {
+            int maxErrors = fields.size() == 3 ? parseMaxErrors(fields[2]) : fuzzyMaxErrors;
+            vector<FuzzyMatch> matches = fuzzySearchNames(rows->names, fields[1], maxErrors, false);
+            for (size_t i = 0; i < matches.size() && i < MAX_SUGGESTIONS; i++) {
+                out << recordLine(rows->students[matches[i].index]) << "\n";
+                reply.status = "SUGGEST";
+            }
+        }
+    }
+    else if ((command == "ADD" && fields.size() == 6) || (command == "UPDATE" && fields.size() == 7)) {
+        size_t first = command == "ADD" ? 1 : 2;
+        Student s;
+        s.name = fields[first];
+        s.section = fields[first + 1].empty() ? "N/A" : fields[first + 1];
+        if (!isValidName(s.name)
+            || !parseGrade(fields[first + 2], s.math)
+            || !parseGrade(fields[first + 3], s.science)
+            || !parseGrade(fields[first + 4], s.english)) {
+            reply.status = "ERR";
+            reply.body = "Invalid student data.\n";
+            return reply;
+        }
+        s.average = (s.math + s.science + s.english) / 3.0;
+        s.remarks = calculateRemarks(s.average);
+        s.updated_at = getCurrentTimestamp();
+
+        lock_guard<mutex> writeGuard(studentCache.writeLock);
+        if (command == "ADD") {
+            s.created_at = s.updated_at;
+            unique_ptr<sql::PreparedStatement> pstmt(db.prepareStatement(
+                "INSERT INTO students (name, section, math, science, english, average, remarks, created_at, updated_at) VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?)"
+            ));
+            pstmt->setString(1, s.name);
+            pstmt->setString(2, s.section);
+            pstmt->setDouble(3, s.math);
+            pstmt->setDouble(4, s.science);
+            pstmt->setDouble(5, s.english);
+            pstmt->setDouble(6, s.average);
+            pstmt->setString(7, s.remarks);
+            pstmt->setString(8, s.updated_at);
+            pstmt->setString(9, s.updated_at);
+            pstmt->execute();
+
+            unique_ptr<sql::Statement> idStmt(db.createStatement());
+            unique_ptr<sql::ResultSet> idRes(idStmt->executeQuery("SELECT LAST_INSERT_ID() AS id"));
+            if (idRes->next()) {
+                s.id = idRes->getInt("id");
+                updateStudentCache([&s](vector<Student>& rows) {
+                    auto it = lower_bound(rows.begin(), rows.end(), s.id, [](const Student& r, int value) { return r.id < value; });
+                    rows.insert(it, s);
+                });
+            }
+            else {
+                dropStudentCache();
+            }
+            out << "✓ Student added successfully!\n";
+        }
+        else {
+            unique_ptr<sql::PreparedStatement> updateStmt(db.prepareStatement(
+                "UPDATE students SET name=?, section=?, math=?, science=?, english=?, average=?, remarks=?, updated_at=? WHERE id=?"
+            ));
+            updateStmt->setString(1, s.name);
+            updateStmt->setString(2, s.section);
+            updateStmt->setDouble(3, s.math);
+            updateStmt->setDouble(4, s.science);
+            updateStmt->setDouble(5, s.english);
+            updateStmt->setDouble(6, s.average);
+            updateStmt->setString(7, s.remarks);
+            updateStmt->setString(8, s.updated_at);
+            s.id = atoi(fields[1].c_str());
+            updateStmt->setInt(9, s.id);
+            int affected = updateStmt->executeUpdate();
+            updateStudentCache([&s](vector<Student>& rows) {
+                auto it = findById(rows, s.id);
+                if (it == rows.end()) return;
+                s.created_at = it->created_at;
+                *it = s;
+            });
+            if (affected > 0) {
+                out << "✓ Student updated successfully!" << endl;
+            }
+            else {
+                reply.status = "NOTFOUND";
+                out << "Student not found." << endl;
+            }
+        }
+    }
+    else if (command == "EXPORT" && fields.size() == 3 && (fields[1] == "csv" || fields[1] == "json")) {
+        // Runs on the export thread (see startExport). Clients only pick a file name; the files
+        // always go to the server's export folder. Streams straight from the database in batches.
+        if (!isSafeExportName(fields[2])) {
+            reply.status = "ERR";
+            out << "Invalid file name: it must not be empty or contain \"/\" or \"..\"." << endl;
+        }
+        else if (!exportData(db, fields[1], serverExportDir + "/" + fields[2], out)) {
+            reply.status = "ERR";
+        }
+    }
+    else if (command == "DELETE" && fields.size() == 2) {
+        unique_ptr<sql::PreparedStatement> deleteStmt(db.prepareStatement(
+            "DELETE FROM students WHERE id = ?"
+        ));
+        int id = atoi(fields[1].c_str());
+        deleteStmt->setInt(1, id);
+        lock_guard<mutex> writeGuard(studentCache.writeLock);
+        int affected = deleteStmt->executeUpdate();
+        updateStudentCache([id](vector<Student>& rows) {
+            auto it = findById(rows, id);
+            if (it != rows.end()) rows.erase(it);
+        });
+        if (affected > 0) {
+            out << "✓ Student deleted successfully!" << endl;
+        }
+        else {
+            reply.status = "NOTFOUND";
+            out << "Failed to delete student." << endl;
+        }
+    }
+    else {
+        reply.status = "ERR";
+        out << "Unknown request." << endl;
+    }
+
+    reply.body = out.str();
+    return reply;
+}
+
+// Frames a reply for sending: "<STATUS> <length>\n" followed by the body
+string frameReply(const ServiceReply& reply) {
+    return reply.status + " " + to_string(reply.body.size()) + "\n" + reply.body;
+}
+
+// A request waiting for a worker, and the framed reply a worker produced
+struct ServerJob {
+    uint64_t clientId = 0;
+    vector<string> fields;
+};
+
+struct ServerResult {
+    uint64_t clientId = 0;
+    string data;
+};
+
+// Small pool of worker threads that run database work off the event loop thread
+struct WorkerPool {
+    mutex jobLock;
+    condition_variable jobReady;
+    deque<ServerJob> jobs;
+    bool stopping = false;
+
+    mutex resultLock;
+    deque<ServerResult> results;
+    int wakeFd = -1;          // eventfd the event loop watches for finished results
+
+    vector<thread> threads;
+
+    mutex exportLock;
+    bool exporting = false;   // A client export is running on exportThread
+    thread exportThread;      // Runs client exports so they do not hold up a worker
+};
+
+// Queues a reply for the event loop to send and wakes it up
+void postResult(WorkerPool& pool, uint64_t clientId, const ServiceReply& reply) {
+    {
+        lock_guard<mutex> guard(pool.resultLock);
+        pool.results.push_back({ clientId, frameReply(reply) });
+    }
+    uint64_t one = 1;
+    if (write(pool.wakeFd, &one, sizeof(one)) < 0) {
+        cerr << "Failed to wake event loop: " << strerror(errno) << endl;
+    }
+}
+
+// Export thread body: runs one client export on its own MySQL connection
+void serverExport(WorkerPool& pool, ServerJob job) {
+    driver->threadInit();
+    ServiceReply reply;
+    try {
+        unique_ptr<sql::Connection> db(openConnection());
+        reply = handleRequest(*db, job.fields);
+    }
+    catch (sql::SQLException& e) {
+        reply.status = "ERR";
+        reply.body = string("MySQL error: ") + e.what() + "\n";
+    }
+    catch (exception& e) {
+        reply.status = "ERR";
+        reply.body = string("Server error: ") + e.what() + "\n";
+    }
+    driver->threadEnd();
+
+    postResult(pool, job.clientId, reply);
+    lock_guard<mutex> guard(pool.exportLock);
+    pool.exporting = false;
+}
+
+// Hands an EXPORT request to the export thread. Only one export runs at a time (each already
+// uses several threads); returns false with a reply filled in when another one is running.
+bool startExport(WorkerPool& pool, ServerJob& job, ServiceReply& reply) {
+    lock_guard<mutex> guard(pool.exportLock);
+    if (pool.exporting) {
+        reply.status = "ERR";
+        reply.body = "The server is busy with another export. Please try again shortly.\n";
+        return false;
+    }
+    if (pool.exportThread.joinable()) pool.exportThread.join();     // Already finished
+    pool.exportThread = thread(serverExport, ref(pool), move(job));
+    pool.exporting = true;
+    return true;
+}
+
+// Worker thread body: owns one MySQL connection and processes jobs until the pool stops
+void serverWorker(WorkerPool& pool) {
+    driver->threadInit();
+    unique_ptr<sql::Connection> db;
+
+    while (true) {
+        ServerJob job;
+        {
+            unique_lock<mutex> guard(pool.jobLock);
+            pool.jobReady.wait(guard, [&pool] { return pool.stopping || !pool.jobs.empty(); });
+            if (pool.stopping && pool.jobs.empty()) break;
+            job = move(pool.jobs.front());
+            pool.jobs.pop_front();
+        }
+
+        ServiceReply reply;
+        try {
+            if (!job.fields.empty() && job.fields[0] == "EXPORT") {
+                if (startExport(pool, job, reply)) continue;   // The export thread replies
+            }
+            else {
+                if (!db) db.reset(openConnection());
+                reply = handleRequest(*db, job.fields);
+            }
+        }
+        catch (sql::SQLException& e) {
+            // Drop the connection so the next job reconnects
+            db.reset();
+            reply.status = "ERR";
+            reply.body = string("MySQL error: ") + e.what() + "\n";
+        }
+        catch (exception& e) {
+            // e.g. bad_alloc, or system_error from starting export threads: fail this request only
+            reply.status = "ERR";
+            reply.body = string("Server error: ") + e.what() + "\n";
+        }
+        postResult(pool, job.clientId, reply);
+    }
+
+    db.reset();
+    driver->threadEnd();
+}
+
+// Per-connection state kept by the event loop
+struct ClientState {
+    int fd = -1;
+    string in;                // Bytes received but not yet handled
+    string out;               // Bytes waiting to be sent
+    bool busy = false;        // A request from this client is with the workers
+    bool closing = false;     // Close once everything in "out" has been sent
+};
+
+// Sends as much buffered output as the socket accepts; returns false if the client should be dropped
+bool flushClient(int epollFd, uint64_t id, ClientState& client) {
+    while (!client.out.empty()) {
+        ssize_t sent = send(client.fd, client.out.data(), client.out.size(), MSG_NOSIGNAL);
+        if (sent < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+            if (errno == EINTR) continue;
+            return false;
+        }
+        client.out.erase(0, static_cast<size_t>(sent));
+    }
+    if (client.out.empty() && client.closing) return false;
+
+    epoll_event ev{};
+    ev.events = EPOLLIN | EPOLLRDHUP | (client.out.empty() ? 0u : static_cast<uint32_t>(EPOLLOUT));
+    ev.data.u64 = id;
+    epoll_ctl(epollFd, EPOLL_CTL_MOD, client.fd, &ev);
+    return true;
+}
+
+// Checks buffered input against the size limits: every line (finished or not) must fit in
+// MAX_REQUEST_LINE and the whole buffer in MAX_PENDING_INPUT
+bool inputTooLarge(const string& in) {
+    if (in.size() > MAX_PENDING_INPUT) return true;
+    size_t start = 0;
+    while (true) {
+        size_t newline = in.find('\n', start);
+        size_t end = newline == string::npos ? in.size() : newline;
+        if (end - start > MAX_REQUEST_LINE) return true;
+        if (newline == string::npos) return false;
+        start = newline + 1;
+    }
+}
+
+// Replies with an error and closes the client once the reply is sent; later results are dropped
+void rejectClient(ClientState& client, const string& message) {
+    ServiceReply reply;
+    reply.status = "ERR";
+    reply.body = message + "\n";
+    client.out += frameReply(reply);
+    client.in.clear();
+    client.closing = true;
+}
+
+// Hands the next complete request line of an idle client to the worker pool
+void dispatchNextRequest(WorkerPool& pool, uint64_t id, ClientState& client) {
+    if (client.busy || client.closing) return;
+    size_t newline = client.in.find('\n');
+    if (newline == string::npos) return;
+
+    string line = client.in.substr(0, newline);
+    client.in.erase(0, newline + 1);
+    if (!line.empty() && line.back() == '\r') line.pop_back();
+
+    {
+        lock_guard<mutex> guard(pool.jobLock);
+        pool.jobs.push_back({ id, splitFields(line, '\t') });
+    }
+    pool.jobReady.notify_one();
+    client.busy = true;
+}
+
+// Runs the dashboard server: one epoll event loop for all clients plus a worker pool for database calls
+int runServer(const string& socketPath) {
+    cout << "=== GRADE ANALYTICS DASHBOARD SERVER ===" << endl;
+    connectDB();
+
+    // Warm the cache once with the startup connection, then leave database work to the workers
+    try {
+        cout << "✓ Cache warmed with " << getCachedStudents(*con)->students.size() << " students" << endl;
+    }
+    catch (sql::SQLException& e) {
+        cerr << "MySQL error: " << e.what() << endl;
+    }
+    disconnectDB();
+
+    // Client exports all go to one folder, created here and reported with a full path
+    if (serverExportDir.empty() || serverExportDir[0] != '/') {
+        char cwd[4096];
+        if (!getcwd(cwd, sizeof(cwd))) {
+            cerr << "Cannot determine the current folder: " << strerror(errno) << endl;
+            return 1;
+        }
+        serverExportDir = string(cwd) + "/" + (serverExportDir.empty() ? "exports" : serverExportDir);
+    }
+    if (mkdir(serverExportDir.c_str(), 0750) < 0 && errno != EEXIST) {
+        cerr << "Cannot create export folder " << serverExportDir << ": " << strerror(errno) << endl;
+        return 1;
+    }
+    cout << "✓ Client exports are written to " << serverExportDir << endl;
+
+    signal(SIGPIPE, SIG_IGN);
+
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    if (socketPath.size() >= sizeof(addr.sun_path)) {
+        cerr << "Socket path is too long: " << socketPath << endl;
+        return 1;
+    }
+    strncpy(addr.sun_path, socketPath.c_str(), sizeof(addr.sun_path) - 1);
+
+    int listenFd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    unlink(socketPath.c_str());
+    if (listenFd < 0
+        || bind(listenFd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0
+        || chmod(socketPath.c_str(), SOCKET_PERMISSIONS) < 0
+        || listen(listenFd, SOMAXCONN) < 0) {
+        cerr << "Failed to listen on " << socketPath << ": " << strerror(errno) << endl;
+        return 1;
+    }
+
+    // SIGINT/SIGTERM are blocked here, before the workers start and inherit the mask, and are
+    // read from a signalfd by the event loop so that they always wake up epoll_wait
+    sigset_t stopSignals;
+    sigemptyset(&stopSignals);
+    sigaddset(&stopSignals, SIGINT);
+    sigaddset(&stopSignals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &stopSignals, nullptr);
+
+    WorkerPool pool;
+    pool.wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    int signalFd = signalfd(-1, &stopSignals, SFD_NONBLOCK | SFD_CLOEXEC);
+    int epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (pool.wakeFd < 0 || signalFd < 0 || epollFd < 0) {
+        cerr << "Failed to set up event loop: " << strerror(errno) << endl;
+        return 1;
+    }
+
+    // Ids 0-2 are reserved for the listening socket, the worker wake-up eventfd and the signalfd
+    const uint64_t LISTEN_ID = 0, WAKE_ID = 1, SIGNAL_ID = 2;
+    epoll_event ev{};
+    ev.events = EPOLLIN;
+    ev.data.u64 = LISTEN_ID;
+    epoll_ctl(epollFd, EPOLL_CTL_ADD, listenFd, &ev);
+    ev.data.u64 = WAKE_ID;
+    epoll_ctl(epollFd, EPOLL_CTL_ADD, pool.wakeFd, &ev);
+    ev.data.u64 = SIGNAL_ID;
+    epoll_ctl(epollFd, EPOLL_CTL_ADD, signalFd, &ev);
+
+    for (int i = 0; i < SERVER_WORKERS; i++) {
+        pool.threads.emplace_back(serverWorker, ref(pool));
+    }
+
+    cout << "✓ Listening on " << socketPath << " with " << SERVER_WORKERS << " workers" << endl;
+    cout << "Press Ctrl+C to stop the server." << endl;
+
+    unordered_map<uint64_t, ClientState> clients;
+    uint64_t nextClientId = SIGNAL_ID + 1;
+
+    // Spare descriptor given up when accept() hits the open-file limit (see the accept loop)
+    int reserveFd = open("/dev/null", O_RDONLY | O_CLOEXEC);
+
+    auto dropClient = [&](uint64_t id) {
+        auto it = clients.find(id);
+        if (it == clients.end()) return;
+        epoll_ctl(epollFd, EPOLL_CTL_DEL, it->second.fd, nullptr);
+        close(it->second.fd);
+        clients.erase(it);
+    };
+
+    bool stopRequested = false;
+    epoll_event events[64];
+    while (!stopRequested) {
+        int ready = epoll_wait(epollFd, events, 64, -1);
+        if (ready < 0) {
+            if (errno == EINTR) continue;
+            cerr << "epoll_wait failed: " << strerror(errno) << endl;
+            break;
+        }
+
+        for (int i = 0; i < ready; i++) {
+            uint64_t id = events[i].data.u64;
+
+            if (id == LISTEN_ID) {
+                while (true) {
+                    int clientFd = accept4(listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+                    if (clientFd < 0) {
+                        if (errno == EINTR) continue;
+                        if ((errno == EMFILE || errno == ENFILE) && reserveFd >= 0) {
+                            // Out of descriptors: free the reserve to accept and close the pending
+                            // client, otherwise level-triggered epoll would report it forever
+                            cerr << "Too many open files; refusing a client" << endl;
+                            close(reserveFd);
+                            int refused = accept4(listenFd, nullptr, nullptr, SOCK_CLOEXEC);
+                            if (refused >= 0) close(refused);
+                            reserveFd = open("/dev/null", O_RDONLY | O_CLOEXEC);
+                            if (refused >= 0) continue;
+                            break;      // accept() reports EMFILE even when nobody is waiting
+                        }
+                        if (errno == EMFILE || errno == ENFILE) {
+                            // No reserve left either: back off instead of spinning on the listener
+                            cerr << "Too many open files; pausing new connections" << endl;
+                            this_thread::sleep_for(chrono::milliseconds(100));
+                            break;
+                        }
+                        if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                            cerr << "accept failed: " << strerror(errno) << endl;
+                        }
+                        break;
+                    }
+                    uint64_t clientId = nextClientId++;
+                    clients[clientId].fd = clientFd;
+                    epoll_event clientEv{};
+                    clientEv.events = EPOLLIN | EPOLLRDHUP;
+                    clientEv.data.u64 = clientId;
+                    epoll_ctl(epollFd, EPOLL_CTL_ADD, clientFd, &clientEv);
+                }
+                continue;
+            }
+
+            if (id == SIGNAL_ID) {
+                signalfd_siginfo info;
+                while (read(signalFd, &info, sizeof(info)) > 0) {}
+                stopRequested = true;
+                continue;
+            }
+
+            if (id == WAKE_ID) {
+                uint64_t count;
+                while (read(pool.wakeFd, &count, sizeof(count)) > 0) {}
+
+                deque<ServerResult> finished;
+                {
+                    lock_guard<mutex> guard(pool.resultLock);
+                    finished.swap(pool.results);
+                }
+                for (ServerResult& result : finished) {
+                    auto it = clients.find(result.clientId);
+                    if (it == clients.end()) continue;      // Client left while its request was running
+                    ClientState& client = it->second;
+                    if (!client.closing) client.out += result.data;
+                    client.busy = false;
+                    dispatchNextRequest(pool, result.clientId, client);
+                    if (!flushClient(epollFd, result.clientId, client)) dropClient(result.clientId);
+                }
+                continue;
+            }
+
+            auto it = clients.find(id);
+            if (it == clients.end()) continue;
+            ClientState& client = it->second;
+
+            if (events[i].events & (EPOLLERR | EPOLLHUP)) {
+                dropClient(id);
+                continue;
+            }
+
+            if (events[i].events & EPOLLIN) {
+                bool peerClosed = false;
+                char buffer[4096];
+                while (true) {
+                    ssize_t received = recv(client.fd, buffer, sizeof(buffer), 0);
+                    if (received > 0) {
+                        // Input from a client that is being closed is read and thrown away
+                        if (client.closing) continue;
+                        client.in.append(buffer, static_cast<size_t>(received));
+                        if (inputTooLarge(client.in)) rejectClient(client, "Request too long.");
+                        continue;
+                    }
+                    if (received == 0) peerClosed = true;
+                    else if (errno == EINTR) continue;
+                    else if (errno != EAGAIN && errno != EWOULDBLOCK) peerClosed = true;
+                    break;
+                }
+                if (peerClosed) {
+                    dropClient(id);
+                    continue;
+                }
+                dispatchNextRequest(pool, id, client);
+            }
+
+            if (!flushClient(epollFd, id, client)) dropClient(id);
+        }
+    }
+
+    cout << "\nShutting down server..." << endl;
+    {
+        lock_guard<mutex> guard(pool.jobLock);
+        pool.stopping = true;
+    }
+    pool.jobReady.notify_all();
+    for (thread& worker : pool.threads) worker.join();
+    if (pool.exportThread.joinable()) pool.exportThread.join();     // Lets a running export finish
+
+    for (auto& entry : clients) close(entry.second.fd);
+    if (reserveFd >= 0) close(reserveFd);
+    close(listenFd);
+    close(pool.wakeFd);
+    close(signalFd);
+    close(epollFd);
+    unlink(socketPath.c_str());
+    cout << "Server stopped." << endl;
+    return 0;
+}
+
+// Connects to a running dashboard server; returns the socket or -1 on failure
+int connectToServer(const string& socketPath) {
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    if (socketPath.size() >= sizeof(addr.sun_path)) return -1;
+    strncpy(addr.sun_path, socketPath.c_str(), sizeof(addr.sun_path) - 1);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) return -1;
+    if (connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// Sends one request to the server and waits for its reply; returns false if the connection broke
+bool sendRequest(int fd, const vector<string>& fields, ServiceReply& reply) {
+    string request = joinFields(fields) + "\n";
+    size_t sentTotal = 0;
+    while (sentTotal < request.size()) {
+        ssize_t sent = send(fd, request.data() + sentTotal, request.size() - sentTotal, MSG_NOSIGNAL);
+        if (sent < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        sentTotal += static_cast<size_t>(sent);
+    }
+
+    // Header line: "<STATUS> <length>"
+    string header;
+    char c;
+    while (true) {
+        ssize_t received = recv(fd, &c, 1, 0);
+        if (received < 0 && errno == EINTR) continue;
+        if (received <= 0) return false;
+        if (c == '\n') break;
+        header += c;
+    }
+    istringstream headerStream(header);
+    size_t length = 0;
+    if (!(headerStream >> reply.status >> length)) return false;
+
+    reply.body.assign(length, '\0');
+    size_t receivedTotal = 0;
+    while (receivedTotal < length) {
+        ssize_t received = recv(fd, &reply.body[receivedTotal], length - receivedTotal, 0);
+        if (received < 0 && errno == EINTR) continue;
+        if (received <= 0) return false;
+        receivedTotal += static_cast<size_t>(received);
+    }
+    return true;
+}
+
+// Adds this client's --max-typos value to a SEARCH/GET request, if one was given
+vector<string> withTypoLimit(vector<string> fields) {
+    if (fuzzyMaxErrorsSet) fields.push_back(to_string(fuzzyMaxErrors));
+    return fields;
+}
+
+// Formats a grade for sending to the server
+string gradeField(double grade) {
+    ostringstream out;
+    out << setprecision(17) << grade;
+    return out.str();
+}
+
+// Prompts for a student name (letters and spaces only) using the given prompt
+string promptStudentName(const string& prompt) {
+    string name;
+    cout << prompt;
+    getline(cin, name);
+    while (!isValidName(name)) {
+        cout << "Please enter a proper name.\n";
+        cout << prompt;
+        getline(cin, name);
+    }
+    return name;
+}
+
+// Thin client: same menu as the standalone program, but every operation runs on the server
+int runClient(const string& socketPath) {
+    int fd = connectToServer(socketPath);
+    if (fd < 0) {
+        cerr << "Could not connect to dashboard server at " << socketPath
+            << " - start it with --server first." << endl;
+        return 1;
+    }
+
+    ServiceReply reply;
+    int choice;
+    do {
+        clearScreen();
+        printMenu();
+        choice = ValidInput("Enter your choice (1-9): ");
+
+        bool ok = true;
+        switch (choice) {
+        case 1: {
+            cout << "\n=== ADD NEW STUDENT ===" << endl;
+            string name = promptStudentName("Enter student name: ");
+            string section;
+            cout << "Enter section: ";
+            getline(cin, section);
+            double math = ValidGrade("Math");
+            double science = ValidGrade("Science");
+            double english = ValidGrade("English");
+            ok = sendRequest(fd, { "ADD", name, section, gradeField(math),
+                gradeField(science), gradeField(english) }, reply);
+            if (ok) cout << reply.body;
+            break;
+        }
+        case 2:
+            ok = sendRequest(fd, { "VIEW" }, reply);
+            if (ok) cout << reply.body;
+            break;
+        case 3:
+        case 4: {
+            bool updating = choice == 3;
+            cout << (updating ? "\n=== UPDATE STUDENT ===" : "\n=== DELETE STUDENT ===") << endl;
+            string name = promptStudentName(updating ? "Enter student name to update: " : "Enter student name to delete: ");
+            ok = sendRequest(fd, withTypoLimit({ "GET", name }), reply);
+            if (!ok) break;
+
+            // Each line of the reply is one record; SUGGEST means there was no exact match
+            vector<Student> candidates;
+            for (const string& line : splitFields(reply.body, '\n')) {
+                Student s;
+                if (parseRecordLine(line, s)) candidates.push_back(s);
+            }
+            if ((reply.status != "OK" && reply.status != "SUGGEST") || candidates.empty()) {
+                cout << "Student not found." << endl;
+                break;
+            }
+            Student current = candidates[0];
+            if (reply.status == "SUGGEST") {
+                vector<const Student*> options;
+                for (const Student& s : candidates) options.push_back(&s);
+                int picked = chooseSuggestion(options);
+                if (picked < 0) {
+                    cout << "Student not found." << endl;
+                    break;
+                }
+                current = candidates[picked];
+            }
+
+            cout << (updating ? "\n--- Current Record ---" : "\n--- Student to be deleted ---") << endl;
+            if (updating) cout << "ID: " << current.id << endl;
+            cout << "Name: " << current.name << endl;
+            cout << "Section: " << current.section << endl;
+            cout << "Math: " << current.math << endl;
+            cout << "Science: " << current.science << endl;
+            cout << "English: " << current.english << endl;
+            cout << "Average: " << current.average << endl;
+            if (updating) cout << "Remarks: " << current.remarks << endl;
+
+            if (updating) {
+                string newName, newSection;
+                cout << "\n--- Enter New Information ---" << endl;
+                cout << "Enter new name (or press Enter to keep current): ";
+                getline(cin, newName);
+                if (newName.empty()) newName = current.name;
+
+                cout << "Enter new section (or press Enter to keep current): ";
+                getline(cin, newSection);
+                if (newSection.empty()) newSection = current.section;
+
+                cout << "Current grades will be updated. Enter new grades:" << endl;
+                double newMath = ValidGrade("Math");
+                double newScience = ValidGrade("Science");
+                double newEnglish = ValidGrade("English");
+                ok = sendRequest(fd, { "UPDATE", to_string(current.id), newName, newSection,
+                    gradeField(newMath), gradeField(newScience), gradeField(newEnglish) }, reply);
+                if (ok) cout << reply.body;
+            }
+            else {
+                char confirm;
+                cout << "\nAre you sure you want to delete this student? (Y/N): ";
+                cin >> confirm;
+                cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                if (toupper(confirm) == 'Y') {
+                    ok = sendRequest(fd, { "DELETE", to_string(current.id) }, reply);
+                    if (ok) cout << reply.body;
+                }
+                else {
+                    cout << "Delete operation cancelled." << endl;
+                }
+            }
+            break;
+        }
+        case 5: {
+            string section;
+            cout << "\n=== SEARCH BY SECTION ===" << endl;
+            cout << "Enter section to search: ";
+            getline(cin, section);
+            ok = sendRequest(fd, { "SECTION", section }, reply);
+            if (ok) cout << reply.body;
+            break;
+        }
+        case 6: {
+            cout << "\n=== SEARCH STUDENT ===" << endl;
+            string name = promptStudentName("Enter student name to search: ");
+            ok = sendRequest(fd, withTypoLimit({ "SEARCH", name }), reply);
+            if (ok) cout << reply.body;
+            break;
+        }
+        case 7:
+            ok = sendRequest(fd, { "ANALYTICS" }, reply);
+            if (ok) cout << reply.body;
+            break;
+        case 8: {
+            string format, baseName;
+            cout << "\n=== EXPORT DATA ===" << endl;
+            promptExportOptions(format, baseName);
+
+            // The server writes the files into its own export folder and replies with their paths
+            cout << "Exporting on the server..." << endl;
+            ok = sendRequest(fd, { "EXPORT", format, baseName }, reply);
+            if (ok) cout << reply.body;
+            break;
+        }
+        case 9:
+            cout << "\nExiting Grade Analytics Dashboard..." << endl;
+            cout << "Thank you for using the system!" << endl;
+            break;
+        default:
+            cout << "Invalid choice. Please select 1-9." << endl;
+        }
+
+        if (!ok) {
+            cerr << "Lost connection to the dashboard server." << endl;
+            close(fd);
+            return 1;
+        }
+
+        if (choice != 9) {
+            cout << "\nPress Enter to continue...";
+            cin.get();
+        }
+
+    } while (choice != 9);
+
+    close(fd);
+    return 0;
+}
+#endif
+
+// Main menu loop: connects to DB, displays menu, dispatches to functions, and closes DB on exit
+// Run with "--server [socket]" to host the dashboard for many users, or "--client [socket]" to use one.
+// "--max-typos N" sets how many typos fuzzy name search tolerates (default 2).
+// "--export-dir DIR" sets the folder the server writes client exports to (default ./exports).
+// "--self-test" checks the fuzzy name search without connecting to the database.
+int main(int argc, char* argv[]) {
+    vector<string> args;
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "--max-typos") {
+            string value = i + 1 < argc ? argv[++i] : "";
+            if (value.empty() || value.size() > 2 || !all_of(value.begin(), value.end(), ::isdigit)) {
+                cerr << "Invalid --max-typos value \"" << value << "\": expected a whole number from 0 to 99." << endl;
+                return 1;
+            }
+            fuzzyMaxErrors = stoi(value);
+            fuzzyMaxErrorsSet = true;
+        }
+        else if (arg == "--export-dir") {
+            if (i + 1 >= argc) {
+                cerr << "--export-dir needs a folder name." << endl;
+                return 1;
+            }
+            serverExportDir = argv[++i];
+        }
+        else {
+            args.push_back(arg);
+        }
+    }
+
+    string mode = args.size() > 0 ? args[0] : "";
+    if (mode == "--self-test") {
+        return runFuzzySelfTest() == 0 ? 0 : 1;
+    }
+    if (mode == "--server" || mode == "--client") {
+#ifdef __linux__
+        string socketPath = args.size() > 1 ? args[1] : DEFAULT_SOCKET_PATH;
+        return mode == "--server" ? runServer(socketPath) : runClient(socketPath);
+#else
+        cerr << "Server and client modes are only available on Linux." << endl;
+        return 1;
+#endif
+    }
+
+    cout << "=== GRADE ANALYTICS DASHBOARD ===" << endl;
+    cout << "Initializing database connection..." << endl;
+
+    connectDB();
+
+    int choice;
+    do {
+        clearScreen();
+        printMenu();
+
+        choice = ValidInput("Enter your choice (1-9): ");
 
         switch (choice) {
         case 1: addStudent(); break;
@@ -696,21 +2560,22 @@ int main() {
         case 5: searchSection(); break;
         case 6: searchStudent(); break;
         case 7: displayAnalytics(); break;
-        case 8:
+        case 8: exportReports(); break;
+        case 9:
             cout << "\nExiting Grade Analytics Dashboard..." << endl;
             cout << "Thank you for using the system!" << endl;
             break;
         default:
-            cout << "Invalid choice. Please select 1-8." << endl;
+            cout << "Invalid choice. Please select 1-9." << endl;
 
         }
 
-        if (choice != 8) {
+        if (choice != 9) {
             cout << "\nPress Enter to continue...";
             cin.get();
         }
 
-    } while (choice != 8);
+    } while (choice != 9);
 
     disconnectDB();
     return 0;